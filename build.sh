@@ -1,5 +1,9 @@
 mkdir -p build
-g++ -o ./build/NFA -c ./src/NFA.cpp
-g++ -o ./build/DFA -c ./src/DFA.cpp
-g++ -o ./build/RegExToNFA_Main -c ./src/RegExToNFA.cpp
-g++ -o ./build/RegExToNFA ./build/RegExToNFA_Main ./build/NFA ./build/DFA
+g++ -pthread -o ./build/NFA -c ./src/NFA.cpp
+g++ -pthread -o ./build/DFA -c ./src/DFA.cpp
+g++ -pthread -o ./build/RegEx -c ./src/RegEx.cpp
+g++ -pthread -o ./build/CompileServer -c ./src/CompileServer.cpp
+g++ -pthread -o ./build/StreamMatcher -c ./src/StreamMatcher.cpp
+g++ -pthread -o ./build/SpanSearcher -c ./src/SpanSearcher.cpp
+g++ -pthread -o ./build/RegExToNFA_Main -c ./src/RegExToNFA.cpp
+g++ -pthread -o ./build/RegExToNFA ./build/RegExToNFA_Main ./build/NFA ./build/DFA ./build/RegEx ./build/CompileServer ./build/StreamMatcher ./build/SpanSearcher
@@ -0,0 +1,146 @@
+#include <sstream>
+#include <thread>
+
+#include "common.hpp"
+
+// a cache is cleared once it has these many entries
+const int MAX_CACHE_SIZE = 4096;
+
+CompileServer::CompileServer(int nWorkers) : nWorkers(nWorkers) {
+  inputClosed = false;
+}
+
+void CompileServer::run(istream& in, ostream& out) {
+  vector<thread> workers;
+  for (int i = 0; i < nWorkers; ++i) {
+    workers.push_back(thread(&CompileServer::processRequests, this, ref(out)));
+  }
+
+  string request;
+  while (getline(in, request)) {
+    if (request.empty()) continue;
+    {
+      lock_guard<mutex> lock(queueMutex);
+      pendingRequests.push(request);
+    }
+    queueCondition.notify_one();
+  }
+  {
+    lock_guard<mutex> lock(queueMutex);
+    inputClosed = true;
+  }
+  queueCondition.notify_all();
+
+  for (thread& worker : workers) {
+    worker.join();
+  }
+}
+
+void CompileServer::processRequests(ostream& out) {
+  while (true) {
+    string request;
+    {
+      unique_lock<mutex> lock(queueMutex);
+      queueCondition.wait(
+          lock, [this] { return inputClosed || !pendingRequests.empty(); });
+      // input is closed and all the requests are handled
+      if (pendingRequests.empty()) return;
+      request = pendingRequests.front();
+      pendingRequests.pop();
+    }
+
+    string response;
+    try {
+      response = handleRequest(request);
+    } catch (const string& e) {
+      response = requestId(request) + " ERROR " + e;
+    } catch (const exception& e) {
+      response = requestId(request) + " ERROR " + e.what();
+    }
+    lock_guard<mutex> lock(outputMutex);
+    out << response << endl;
+  }
+}
+
+string CompileServer::requestId(string& request) {
+  istringstream requestStream(request);
+  string id;
+  requestStream >> id;
+  return id;
+}
+
+string CompileServer::handleRequest(string& request) {
+  istringstream requestStream(request);
+  string id, command;
+  int nSymbols = 0;
+  requestStream >> id >> command >> nSymbols;
+  if (command != "COMPILE" && command != "MATCH") {
+    return id + " ERROR Unknown command";
+  }
+
+  // symbols, regex and the word
+  vector<string> tokens;
+  string token;
+  while (requestStream >> token) {
+    tokens.push_back(token);
+  }
+  if (nSymbols <= 0 || nSymbols > tokens.size()) {
+    return id + " ERROR Invalid alphabet";
+  }
+  if (nSymbols == tokens.size()) {
+    return id + " ERROR " + INVALID_REGEX_EXCEPTION;
+  }
+
+  vector<string> symbols(tokens.begin(), tokens.begin() + nSymbols);
+  shared_ptr<DFA> dfa = getDFA(symbols, tokens[nSymbols]);
+  if (command == "COMPILE") {
+    return id + " OK";
+  }
+
+  vector<string> word(tokens.begin() + nSymbols + 1, tokens.end());
+  return id + (dfa->acceptsWord(word) ? " ACCEPT" : " REJECT");
+}
+
+shared_ptr<DFA> CompileServer::getDFA(vector<string>& symbols,
+                                      string& regExStr) {
+  string alphabetKey = "";
+  for (string& sym : symbols) {
+    alphabetKey += sym + " ";
+  }
+  string dfaKey = alphabetKey + "|" + regExStr;
+
+  shared_ptr<unordered_map<string, int>> alphabetMap;
+  {
+    lock_guard<mutex> lock(cacheMutex);
+    auto cachedDFA = dfaCache.find(dfaKey);
+    if (cachedDFA != dfaCache.end()) return cachedDFA->second;
+    auto cachedAlphabet = alphabetCache.find(alphabetKey);
+    if (cachedAlphabet != alphabetCache.end()) {
+      alphabetMap = cachedAlphabet->second;
+    }
+  }
+
+  if (!alphabetMap) {
+    alphabetMap = make_shared<unordered_map<string, int>>();
+    for (int i = 0; i < symbols.size(); ++i) {
+      if (!alphabetMap->insert(make_pair(symbols[i], i)).second) {
+        throw string("Symbols must be unique");
+      }
+    }
+  }
+
+  // compiled without holding the lock, a regex requested concurrently by
+  // several workers may get compiled more than once
+  shared_ptr<DFA> dfa(regExToDFA(regExStr, *alphabetMap));
+
+  lock_guard<mutex> lock(cacheMutex);
+  if (alphabetCache.size() >= MAX_CACHE_SIZE) {
+    alphabetCache.clear();
+  }
+  alphabetCache.insert(make_pair(alphabetKey, alphabetMap));
+  if (dfaCache.size() >= MAX_CACHE_SIZE) {
+    dfaCache.clear();
+  }
+  dfaCache.insert(make_pair(dfaKey, dfa));
+  return dfa;
+}
@@ -0,0 +1,57 @@
+#ifndef __COMPILE_SERVER_HPP__
+#define __COMPILE_SERVER_HPP__
+
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DFA.hpp"
+
+using namespace std;
+
+// Line-delimited request/response server (one request per line)
+// Requests:
+//   <id> COMPILE <n> <sym_1> ... <sym_n> <regex>
+//   <id> MATCH <n> <sym_1> ... <sym_n> <regex> <w_1> ... <w_k>
+// Responses (may be out of order, use <id> to pair them with the requests):
+//   <id> OK
+//   <id> ACCEPT | <id> REJECT
+//   <id> ERROR <message>
+// alphabets and DFAs are cached across requests (DFAs are not minimized, as
+// matching doesn't need it)
+class CompileServer {
+ public:
+  CompileServer(int nWorkers);
+  void run(istream& in, ostream& out);
+
+ private:
+  int nWorkers;
+
+  // caches (guarded by cacheMutex)
+  // key: "sym_1 sym_2 ... sym_n "
+  unordered_map<string, shared_ptr<unordered_map<string, int>>> alphabetCache;
+  // key: alphabet key + "|" + regex
+  unordered_map<string, shared_ptr<DFA>> dfaCache;
+  mutex cacheMutex;
+
+  // requests read but not yet handled (guarded by queueMutex)
+  queue<string> pendingRequests;
+  bool inputClosed;
+  mutex queueMutex;
+  condition_variable queueCondition;
+
+  mutex outputMutex;
+
+  void processRequests(ostream& out);
+  // errors are thrown (as string or exception)
+  string handleRequest(string& request);
+  string requestId(string& request);
+  shared_ptr<DFA> getDFA(vector<string>& symbols, string& regExStr);
+};
+
+#endif
@@ -256,4 +256,160 @@ vector<vector<int>> DFA::getTransistionFn() { return this->transistionFn; }
 
 int DFA::getStartState() { return this->startState; }
 
-set<int> DFA::getFinalStates() { return this->finalStates; }
\ No newline at end of file
+set<int> DFA::getFinalStates() { return this->finalStates; }
+
+// syms1[i], syms2[i] -> id of the i-th symbol of (Sigma1 union Sigma2) in
+// this DFA and dfa2 (-1 if the DFA does not have the symbol)
+void DFA::alignAlphabetWith(DFA& dfa2, vector<int>& syms1,
+                            vector<int>& syms2) {
+  syms1.clear();
+  syms2.clear();
+  for (auto symIdPair : alphabet) {
+    syms1.push_back(symIdPair.second);
+    auto sym2 = dfa2.alphabet.find(symIdPair.first);
+    syms2.push_back(sym2 != dfa2.alphabet.end() ? sym2->second : -1);
+  }
+  for (auto symIdPair : dfa2.alphabet) {
+    if (alphabet.find(symIdPair.first) != alphabet.end()) continue;
+    syms1.push_back(-1);
+    syms2.push_back(symIdPair.second);
+  }
+}
+
+// a symbol missing from the alphabet leads to phi (id = 0)
+int DFA::nextState(int q, int sym) {
+  return sym >= 0 ? transistionFn[q][sym] : 0;
+}
+
+bool DFA::isEquivalentTo(DFA& dfa2) {
+  // Hopcroft-Karp
+  // states of dfa2 are shifted by this->numStates, each set in the union-find
+  // is a set of states that must be equivalent if L1 = L2
+  vector<int> syms1, syms2;
+  alignAlphabetWith(dfa2, syms1, syms2);
+  int nSyms = syms1.size();
+
+  vector<int> parent(numStates + dfa2.numStates);
+  for (int q = 0; q < parent.size(); ++q) {
+    parent[q] = q;
+  }
+  auto findSet = [&parent](int q) {
+    while (parent[q] != q) {
+      parent[q] = parent[parent[q]];
+      q = parent[q];
+    }
+    return q;
+  };
+
+  queue<pair<int, int>> processingQueue;
+  parent[findSet(dfa2.startState + numStates)] = findSet(startState);
+  processingQueue.push(make_pair(startState, dfa2.startState));
+
+  // product states are created only when they are reached
+  while (!processingQueue.empty()) {
+    pair<int, int> u = processingQueue.front();
+    processingQueue.pop();
+    // exactly one of the states is final -> some string is in only one of L1
+    // and L2
+    if ((finalStates.find(u.first) == finalStates.end()) !=
+        (dfa2.finalStates.find(u.second) == dfa2.finalStates.end())) {
+      return false;
+    }
+    for (int sym = 0; sym < nSyms; ++sym) {
+      int q1 = nextState(u.first, syms1[sym]);
+      int q2 = dfa2.nextState(u.second, syms2[sym]);
+      int root1 = findSet(q1);
+      int root2 = findSet(q2 + numStates);
+      if (root1 == root2) continue;
+      parent[root2] = root1;
+      processingQueue.push(make_pair(q1, q2));
+    }
+  }
+  return true;
+}
+
+bool DFA::isSubsetOf(DFA& dfa2) {
+  // inclusion is not symmetric, so union-find can't be used
+  // L1 c L2 iff no reachable product state (q1, q2) has q1 in F1 and q2 not
+  // in F2
+  vector<int> syms1, syms2;
+  alignAlphabetWith(dfa2, syms1, syms2);
+  int nSyms = syms1.size();
+
+  // product state (q1, q2) -> q1 * dfa2.numStates + q2
+  unordered_set<long long> visited;
+  queue<pair<int, int>> processingQueue;
+  visited.insert((long long)startState * dfa2.numStates + dfa2.startState);
+  processingQueue.push(make_pair(startState, dfa2.startState));
+
+  while (!processingQueue.empty()) {
+    pair<int, int> u = processingQueue.front();
+    processingQueue.pop();
+    if (finalStates.find(u.first) != finalStates.end() &&
+        dfa2.finalStates.find(u.second) == dfa2.finalStates.end()) {
+      return false;
+    }
+    // nothing is accepted from phi
+    if (u.first == 0) continue;
+    for (int sym = 0; sym < nSyms; ++sym) {
+      int q1 = nextState(u.first, syms1[sym]);
+      int q2 = dfa2.nextState(u.second, syms2[sym]);
+      if (visited.insert((long long)q1 * dfa2.numStates + q2).second) {
+        processingQueue.push(make_pair(q1, q2));
+      }
+    }
+  }
+  return true;
+}
+
+int DFA::getMinState(int q) {
+  auto eqState = equivalentState.find(q);
+  return eqState != equivalentState.end() ? eqState->second : q;
+}
+
+// minimized DFA with states renumbered in BFS order from the start state,
+// symbols are visited in sorted order so that DFAs accepting the same language
+// (over the same alphabet) have the same canonical form
+// format: "sym1 sym2 ... |" + for each state: ("F" or "N") + "q1,q2,...;"
+string DFA::getCanonicalMinDFA() {
+  vector<pair<string, int>> sortedSyms(alphabet.begin(), alphabet.end());
+  sort(sortedSyms.begin(), sortedSyms.end());
+
+  string canonicalForm = "";
+  for (auto symIdPair : sortedSyms) {
+    canonicalForm += symIdPair.first + " ";
+  }
+  canonicalForm += "|";
+
+  unordered_map<int, int> canonicalId;
+  queue<int> pendingStatesQueue;
+  int minStartState = getMinState(startState);
+  canonicalId.insert(make_pair(minStartState, 0));
+  pendingStatesQueue.push(minStartState);
+  while (!pendingStatesQueue.empty()) {
+    int q = pendingStatesQueue.front();
+    pendingStatesQueue.pop();
+    canonicalForm += (finalStates.find(q) != finalStates.end() ? "F" : "N");
+    for (auto symIdPair : sortedSyms) {
+      int trState = getMinState(transistionFn[q][symIdPair.second]);
+      if (canonicalId.find(trState) == canonicalId.end()) {
+        int id = canonicalId.size();
+        canonicalId.insert(make_pair(trState, id));
+        pendingStatesQueue.push(trState);
+      }
+      canonicalForm += to_string(canonicalId[trState]) + ",";
+    }
+    canonicalForm += ";";
+  }
+  return canonicalForm;
+}
+
+bool DFA::acceptsWord(vector<string>& word) {
+  int q = startState;
+  for (string& sym : word) {
+    auto symIdPair = alphabet.find(sym);
+    if (symIdPair == alphabet.end()) return false;
+    q = transistionFn[q][symIdPair->second];
+  }
+  return finalStates.find(q) != finalStates.end();
+}
@@ -21,6 +21,14 @@ class DFA {
   vector<vector<int>> getTransistionFn();
   int getStartState();
   set<int> getFinalStates();
+  // equivalence and inclusion don't need a minimized DFA
+  bool isEquivalentTo(DFA& dfa2);
+  bool isSubsetOf(DFA& dfa2);
+  // assm: minimizeDFA() has been called
+  int getMinState(int q);
+  string getCanonicalMinDFA();
+  // word is a sequence of symbols, false if a symbol is not in the alphabet
+  bool acceptsWord(vector<string>& word);
 
  private:
   // Q -> {0, 1, ... numStates-1}
@@ -41,6 +49,9 @@ class DFA {
   unordered_map<int, int> equivalentState;
 
   string setToString(set<int>& S);
+  // for equivalence and inclusion
+  void alignAlphabetWith(DFA& dfa2, vector<int>& syms1, vector<int>& syms2);
+  int nextState(int q, int sym);
 };
 
 #endif
\ No newline at end of file
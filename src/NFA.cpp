@@ -11,7 +11,9 @@ NFA::NFA(string symbol, unordered_map<string, int>& alphabet)
       numStates, vector<set<int>>(nAlphabet + 1, set<int>()));
 
   // symbol must be from the alphabet
-  assert(alphabet.find(symbol) != alphabet.end());
+  if (alphabet.find(symbol) == alphabet.end()) {
+    throw INVALID_SYMBOL_EXCEPTION;
+  }
 
   // populate this->alphabetIdToSym using alphabet
   // assm : in alphabet, each symbol has a unique id
@@ -209,3 +211,62 @@ vector<vector<set<int>>> NFA::getTransistionFn() { return this->transistionFn; }
 int NFA::getStartState() { return this->startState; }
 
 set<int> NFA::getFinalStates() { return this->finalStates; }
+
+// assm: NFA has no eps transitions (convertEpsNFAToNFA() has been called)
+void NFA::applyReversal() {
+  int nAlphabet = alphabet.size();
+  // reverse all the transitions
+  vector<vector<set<int>>> reversedTrFn(
+      numStates, vector<set<int>>(nAlphabet + 1, set<int>()));
+  for (int qi = 0; qi < numStates; ++qi) {
+    for (int sym = 0; sym < nAlphabet; ++sym) {
+      for (int qj : transistionFn[qi][sym]) {
+        reversedTrFn[qj][sym].insert(qi);
+      }
+    }
+  }
+  // add a new state: qk
+  // qk has the transitions of all the old final states (instead of eps
+  // transitions to them, so that the NFA stays eps-free)
+  int qk = numStates;
+  numStates++;
+  reversedTrFn.push_back(vector<set<int>>(nAlphabet + 1, set<int>()));
+  assert(numStates == reversedTrFn.size());
+  for (int qF : finalStates) {
+    for (int sym = 0; sym < nAlphabet; ++sym) {
+      for (int q : reversedTrFn[qF][sym]) {
+        reversedTrFn[qk][sym].insert(q);
+      }
+    }
+  }
+  transistionFn = reversedTrFn;
+  // old start state is the new final state
+  // qk is also a final state if eps was accepted
+  set<int> newFinalStates = {startState};
+  if (finalStates.find(startState) != finalStates.end()) {
+    newFinalStates.insert(qk);
+  }
+  finalStates = newFinalStates;
+  // qk is new start state
+  startState = qk;
+}
+
+// L -> Sigma* L
+// assm: NFA has no eps transitions (convertEpsNFAToNFA() has been called)
+void NFA::applySigmaStarPrefix() {
+  int nAlphabet = alphabet.size();
+  // add a new state: qk
+  // qk loops on every symbol and also has the transitions of the start state
+  int qk = numStates;
+  numStates++;
+  transistionFn.push_back(transistionFn[startState]);
+  assert(numStates == transistionFn.size());
+  for (int sym = 0; sym < nAlphabet; ++sym) {
+    transistionFn[qk][sym].insert(qk);
+  }
+  if (finalStates.find(startState) != finalStates.end()) {
+    finalStates.insert(qk);
+  }
+  // qk is new start state
+  startState = qk;
+}
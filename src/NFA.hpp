@@ -15,6 +15,9 @@ class NFA {
   void applyKleeneStar();
   void applyConcatenationWith(NFA& nfa);
   void applyUnionWith(NFA& nfa);
+  // assm: epsilon-NFA has been converted to NFA
+  void applyReversal();
+  void applySigmaStarPrefix();
   void printNFA();
   int getNumStates();
   unordered_map<string, int> getAlphabet();
@@ -0,0 +1,150 @@
+#include "common.hpp"
+
+void applyOperation(stack<string>& args, stack<NFA*>& argsNFA, string operation,
+                    unordered_map<string, int>& alphabetMap) {
+  // op = * -> pop one operand -> append * to it -> push it back
+  if (operation == "*") {
+    if (args.size() < 1 || argsNFA.size() < 1) {
+      throw INVALID_REGEX_EXCEPTION;
+    }
+    string val = "[" + args.top() + " *]";
+    args.pop();
+    argsNFA.top()->applyKleeneStar();
+    args.push(val);
+
+  }
+  // op = (. or +) -> pop two ops append them one after another -> append
+  // (. or +) -> push it back
+  else if (operation == "+" || operation == ".") {
+    if (args.size() < 2 || argsNFA.size() < 2) {
+      throw INVALID_REGEX_EXCEPTION;
+    }
+    string arg1 = args.top();
+    NFA* nfa1 = argsNFA.top();
+    args.pop();
+    argsNFA.pop();
+
+    string arg2 = args.top();
+    args.pop();
+    args.push("[" + arg2 + " " + arg1 + " " + operation + "]");
+
+    if (operation == ".")
+      argsNFA.top()->applyConcatenationWith(*nfa1);
+    else
+      argsNFA.top()->applyUnionWith(*nfa1);
+    delete nfa1;
+  }
+}
+
+void evaluateRegEx(string regExStr, unordered_map<string, int>& alphabetMap,
+                   stack<string>& args, stack<NFA*>& argsNFA) {
+  // evaluate reg-exp
+  stack<string> operations;
+  string currOperand = "";
+  for (int i = 0; i < regExStr.size(); ++i) {
+    // if an op -> process
+    switch (regExStr[i]) {
+      case '(': {
+        if (currOperand != "") {
+          args.push(currOperand);
+          argsNFA.push(new NFA(currOperand, alphabetMap));
+          currOperand = "";
+        }
+        operations.push("(");
+        break;
+      }
+      case ')': {
+        if (currOperand != "") {
+          args.push(currOperand);
+          argsNFA.push(new NFA(currOperand, alphabetMap));
+          currOperand = "";
+        }
+        // keep popping till '(' is found
+        while (!operations.empty() && operations.top() != "(") {
+          applyOperation(args, argsNFA, operations.top(), alphabetMap);
+          operations.pop();
+        }
+        if (operations.empty()) {
+          throw INVALID_REGEX_EXCEPTION;
+        }
+        operations.pop();
+        break;
+      }
+      case '*': {
+        if (currOperand != "") {
+          args.push(currOperand);
+          argsNFA.push(new NFA(currOperand, alphabetMap));
+          currOperand = "";
+        }
+        // push it to the operand
+        applyOperation(args, argsNFA, "*", alphabetMap);
+        break;
+      }
+      case '+': {
+        if (currOperand != "") {
+          args.push(currOperand);
+          argsNFA.push(new NFA(currOperand, alphabetMap));
+          currOperand = "";
+        }
+        // if operand-stack has . on top -> process and pop it
+        while (!operations.empty() && operations.top() == ".") {
+          applyOperation(args, argsNFA, operations.top(), alphabetMap);
+          operations.pop();
+        }
+        operations.push("+");
+        break;
+      }
+      case '.': {
+        if (currOperand != "") {
+          args.push(currOperand);
+          argsNFA.push(new NFA(currOperand, alphabetMap));
+          currOperand = "";
+        }
+        operations.push(".");
+        break;
+      }
+      default: {
+        currOperand += regExStr[i];
+      }
+    }
+  }
+  if (currOperand != "") {
+    args.push(currOperand);
+    argsNFA.push(new NFA(currOperand, alphabetMap));
+    currOperand = "";
+  }
+  while (!operations.empty()) {
+    applyOperation(args, argsNFA, operations.top(), alphabetMap);
+    operations.pop();
+  }
+  if (args.size() != 1 || argsNFA.size() != 1) {
+    throw INVALID_REGEX_EXCEPTION;
+  }
+}
+
+NFA* regExToEpsNFA(string regExStr, unordered_map<string, int>& alphabetMap,
+                   string& postFix) {
+  stack<string> args;
+  stack<NFA*> argsNFA;
+  try {
+    evaluateRegEx(regExStr, alphabetMap, args, argsNFA);
+  } catch (...) {
+    // free the partially evaluated operands
+    while (!argsNFA.empty()) {
+      delete argsNFA.top();
+      argsNFA.pop();
+    }
+    throw;
+  }
+  postFix = args.top();
+  return argsNFA.top();
+}
+
+DFA* regExToDFA(string regExStr, unordered_map<string, int>& alphabetMap) {
+  string postFix;
+  NFA* nfa = regExToEpsNFA(regExStr, alphabetMap, postFix);
+  nfa->convertEpsNFAToNFA();
+  DFA* dfa = new DFA(*nfa);
+  delete nfa;
+  return dfa;
+}
@@ -0,0 +1,21 @@
+#ifndef __REGEX_HPP__
+#define __REGEX_HPP__
+
+#include <string>
+#include <unordered_map>
+
+#include "DFA.hpp"
+#include "NFA.hpp"
+
+using namespace std;
+
+// evaluates regExStr (post-fix evaluation) and returns the epsilon-NFA for it
+// post-fix form of the regExStr is stored in postFix
+// caller owns the returned NFA
+NFA* regExToEpsNFA(string regExStr, unordered_map<string, int>& alphabetMap,
+                   string& postFix);
+// RegEx -> epsilon-NFA -> NFA -> DFA
+// caller owns the returned DFA
+DFA* regExToDFA(string regExStr, unordered_map<string, int>& alphabetMap);
+
+#endif
@@ -1,49 +1,18 @@
-#include "common.hpp"
-
-void applyOperation(stack<string>& args, stack<NFA*>& argsNFA, string operation,
-                    unordered_map<string, int>& alphabetMap) {
-  // op = * -> pop one operand -> append * to it -> push it back
-  if (operation == "*") {
-    if (args.size() < 1 && argsNFA.size() < 1) {
-      throw INVALID_REGEX_EXCEPTION;
-    }
-    string val = "[" + args.top() + " *]";
-    args.pop();
-    argsNFA.top()->applyKleeneStar();
-    args.push(val);
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <thread>
 
-  }
-  // op = (. or +) -> pop two ops append them one after another -> append
-  // (. or +) -> push it back
-  else if (operation == "+" || operation == ".") {
-    if (args.size() < 2 && argsNFA.size() < 2) {
-      throw INVALID_REGEX_EXCEPTION;
-    }
-    string arg1 = args.top();
-    NFA* nfa1 = argsNFA.top();
-    args.pop();
-    argsNFA.pop();
-
-    string arg2 = args.top();
-    args.pop();
-    args.push("[" + arg2 + " " + arg1 + " " + operation + "]");
-
-    if (operation == ".")
-      argsNFA.top()->applyConcatenationWith(*nfa1);
-    else
-      argsNFA.top()->applyUnionWith(*nfa1);
-    delete nfa1;
-  }
-}
+#include "common.hpp"
 
-int main() {
-  string regExStr;
+// reads the alphabet from stdin into alphabetMap
+// returns false if the symbols are not unique
+bool readAlphabet(unordered_map<string, int>& alphabetMap) {
   int lenAlphabet;
   cout << "Enter number of symbols (characters) in the alphabet: " << endl;
   cin >> lenAlphabet;
 
   vector<string> alphabet(lenAlphabet);
-  unordered_map<string, int> alphabetMap;
 
   cout << "Enter " << lenAlphabet
        << " symbols seperated by a space (symbol must contain characters from "
@@ -54,110 +23,228 @@ int main() {
     cin >> alphabet[i];
     if (alphabetMap.find(alphabet[i]) != alphabetMap.end()) {
       cout << "Symbols must be unique\n";
-      return 0;
+      return false;
     }
     alphabetMap.insert(make_pair(alphabet[i], i));
   }
+  return true;
+}
+
+// --equiv: decides L1 = L2, L1 c L2 and L2 c L1 for two regular-expressions
+// (product of the two DFAs is explored on the fly, neither is minimized)
+int checkEquivalence() {
+  unordered_map<string, int> alphabetMap;
+  if (!readAlphabet(alphabetMap)) return 0;
+
+  string regExStr1, regExStr2;
+  cout << "Enter regular-expression-1: " << endl;
+  cin >> regExStr1;
+  cout << "Enter regular-expression-2: " << endl;
+  cin >> regExStr2;
+
+  DFA* dfa1 = regExToDFA(regExStr1, alphabetMap);
+  DFA* dfa2 = regExToDFA(regExStr2, alphabetMap);
+  cout << "L1 = L2: " << (dfa1->isEquivalentTo(*dfa2) ? "yes" : "no") << "\n";
+  cout << "L1 \u2286 L2: " << (dfa1->isSubsetOf(*dfa2) ? "yes" : "no")
+       << "\n";
+  cout << "L2 \u2286 L1: " << (dfa2->isSubsetOf(*dfa1) ? "yes" : "no")
+       << "\n";
+  delete dfa1;
+  delete dfa2;
+  return 0;
+}
+
+// --dedup: groups regular-expressions that accept the same language
+// (hashes the canonical form of each minimized DFA)
+int deduplicateRegExs() {
+  unordered_map<string, int> alphabetMap;
+  if (!readAlphabet(alphabetMap)) return 0;
+
+  int nRegEx;
+  cout << "Enter number of regular-expressions: " << endl;
+  cin >> nRegEx;
+  vector<string> regExs(nRegEx);
+  cout << "Enter " << nRegEx
+       << " regular-expressions seperated by a white-space: " << endl;
+  for (int i = 0; i < nRegEx; ++i) {
+    cin >> regExs[i];
+  }
+
+  // canonical form -> ids of the regular-expressions
+  unordered_map<string, vector<int>> languageToRegExs;
+  // order in which the languages were first seen
+  vector<string> languages;
+  for (int i = 0; i < nRegEx; ++i) {
+    DFA* dfa = regExToDFA(regExs[i], alphabetMap);
+    dfa->minimizeDFA();
+    string canonicalForm = dfa->getCanonicalMinDFA();
+    delete dfa;
+    if (languageToRegExs.find(canonicalForm) == languageToRegExs.end()) {
+      languages.push_back(canonicalForm);
+    }
+    languageToRegExs[canonicalForm].push_back(i);
+  }
+
+  cout << "Unique languages: " << languages.size() << "\n";
+  for (int lang = 0; lang < languages.size(); ++lang) {
+    cout << "L" << lang << ": ";
+    for (int i : languageToRegExs[languages[lang]]) {
+      cout << regExs[i] << ", ";
+    }
+    cout << "\n";
+  }
+  return 0;
+}
+
+// --stream: reads a regular-expression and runs its minimized DFA over rest of
+// the input, which is fed to the matcher in chunks of chunkSize characters
+int matchStream(int chunkSize) {
+  unordered_map<string, int> alphabetMap;
+  if (!readAlphabet(alphabetMap)) return 0;
 
+  string regExStr;
   cout << "Enter regular-expression: " << endl;
   cin >> regExStr;
+  // input starts on the next line (offsets are counted from there)
+  cin.ignore(numeric_limits<streamsize>::max(), '\n');
+  cout << "Enter the input (symbols may or may not be seperated by "
+          "white-spaces): "
+       << endl;
 
-  // evaluate reg-exp
-  stack<string> operations, args;
-  stack<NFA*> argsNFA;
-  string currOperand = "";
-  for (int i = 0; i < regExStr.size(); ++i) {
-    // if an op -> process
-    switch (regExStr[i]) {
-      case '(': {
-        if (currOperand != "") {
-          args.push(currOperand);
-          argsNFA.push(new NFA(currOperand, alphabetMap));
-          currOperand = "";
-        }
-        operations.push("(");
-        break;
-      }
-      case ')': {
-        if (currOperand != "") {
-          args.push(currOperand);
-          argsNFA.push(new NFA(currOperand, alphabetMap));
-          currOperand = "";
-        }
-        // keep popping till '(' is found
-        while (!operations.empty() && operations.top() != "(") {
-          applyOperation(args, argsNFA, operations.top(), alphabetMap);
-          operations.pop();
-        }
-        if (operations.empty()) {
-          throw INVALID_REGEX_EXCEPTION;
-        }
-        operations.pop();
-        break;
-      }
-      case '*': {
-        if (currOperand != "") {
-          args.push(currOperand);
-          argsNFA.push(new NFA(currOperand, alphabetMap));
-          currOperand = "";
-        }
-        // push it to the operand
-        applyOperation(args, argsNFA, "*", alphabetMap);
-        break;
-      }
-      case '+': {
-        if (currOperand != "") {
-          args.push(currOperand);
-          argsNFA.push(new NFA(currOperand, alphabetMap));
-          currOperand = "";
-        }
-        // if operand-stack has . on top -> process and pop it
-        while (!operations.empty() && operations.top() == ".") {
-          applyOperation(args, argsNFA, operations.top(), alphabetMap);
-          operations.pop();
-        }
-        operations.push("+");
-        break;
-      }
-      case '.': {
-        if (currOperand != "") {
-          args.push(currOperand);
-          argsNFA.push(new NFA(currOperand, alphabetMap));
-          currOperand = "";
-        }
-        operations.push(".");
-        break;
-      }
-      default: {
-        currOperand += regExStr[i];
+  DFA* dfa = regExToDFA(regExStr, alphabetMap);
+  dfa->minimizeDFA();
+  StreamMatcher matcher(*dfa);
+  if (!matcher.isAlphabetPrefixFree()) {
+    cout << "Warning: a symbol is a prefix of another symbol, symbols are "
+            "split greedily (seperate them with white-spaces)\n";
+  }
+  matcher.setMatchCallback([](long long offset) {
+    cout << "Accepted prefix ending at offset " << offset << "\n";
+  });
+
+  vector<char> chunk(chunkSize);
+  while (cin.read(chunk.data(), chunkSize) || cin.gcount() > 0) {
+    if (!matcher.feed(chunk.data(), cin.gcount())) break;
+  }
+  // finish() may report the last symbol
+  bool isAccepted = matcher.finish();
+  cout << "Accepted: " << (isAccepted ? "yes" : "no") << endl;
+  delete dfa;
+  return 0;
+}
+
+// --search: reads a regular-expression and a word (symbols seperated by
+// white-spaces, till the end of the input) and prints all the non-overlapping
+// leftmost-longest matches
+// --search-bench: same matches in a random word of benchLen symbols, found
+// with the reverse DFA and by running the forward DFA from every position
+int searchSpans(bool isBench, int benchLen) {
+  unordered_map<string, int> alphabetMap;
+  if (!readAlphabet(alphabetMap)) return 0;
+
+  string regExStr;
+  cout << "Enter regular-expression: " << endl;
+  cin >> regExStr;
+
+  string postFix;
+  NFA* nfa = regExToEpsNFA(regExStr, alphabetMap, postFix);
+  nfa->convertEpsNFAToNFA();
+  SpanSearcher searcher(*nfa);
+  delete nfa;
+
+  vector<int> word;
+  if (isBench) {
+    srand(0);
+    for (int i = 0; i < benchLen; ++i) {
+      word.push_back(rand() % alphabetMap.size());
+    }
+  } else {
+    cout << "Enter the word (symbols seperated by white-spaces): " << endl;
+    string sym;
+    while (cin >> sym) {
+      if (alphabetMap.find(sym) == alphabetMap.end()) {
+        throw INVALID_SYMBOL_EXCEPTION;
       }
+      word.push_back(alphabetMap[sym]);
     }
   }
-  if (currOperand != "") {
-    args.push(currOperand);
-    argsNFA.push(new NFA(currOperand, alphabetMap));
-    currOperand = "";
-  }
-  while (!operations.empty()) {
-    applyOperation(args, argsNFA, operations.top(), alphabetMap);
-    operations.pop();
+
+  auto startTime = chrono::steady_clock::now();
+  vector<pair<int, int>> spans = searcher.findAllSpans(word);
+  auto endTime = chrono::steady_clock::now();
+  if (!isBench) {
+    cout << "Matches: ";
+    for (auto span : spans) {
+      cout << "[" << span.first << ", " << span.second << "), ";
+    }
+    cout << "\n";
+    return 0;
   }
-  if (args.size() != 1 && argsNFA.size() != 1) {
-    throw INVALID_REGEX_EXCEPTION;
+
+  vector<pair<int, int>> naiveSpans = searcher.findAllSpansNaive(word);
+  auto naiveEndTime = chrono::steady_clock::now();
+  cout << "Matches: " << spans.size() << " (naive: " << naiveSpans.size()
+       << ", " << (spans == naiveSpans ? "same" : "different") << ")\n";
+  cout << "Forward + reverse DFA: "
+       << chrono::duration_cast<chrono::microseconds>(endTime - startTime)
+              .count()
+       << " us\n";
+  cout << "Naive rescan: "
+       << chrono::duration_cast<chrono::microseconds>(naiveEndTime - endTime)
+              .count()
+       << " us\n";
+  return 0;
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1) {
+    string mode = argv[1];
+    if (mode == "--equiv") return checkEquivalence();
+    if (mode == "--dedup") return deduplicateRegExs();
+    if (mode == "--stream") {
+      int chunkSize = argc > 2 ? atoi(argv[2]) : 4096;
+      return matchStream(max(chunkSize, 1));
+    }
+    if (mode == "--search") return searchSpans(false, 0);
+    if (mode == "--search-bench") {
+      int benchLen = argc > 2 ? atoi(argv[2]) : 1000000;
+      return searchSpans(true, max(benchLen, 0));
+    }
+    if (mode == "--server") {
+      int nWorkers = argc > 2 ? atoi(argv[2]) : thread::hardware_concurrency();
+      CompileServer server(max(nWorkers, 1));
+      server.run(cin, cout);
+      return 0;
+    }
+    cout << "Usage: " << argv[0]
+         << " [--equiv | --dedup | --stream [chunk size] | --search |"
+            " --search-bench [word length] | --server [number of workers]]\n";
+    return 1;
   }
-  cout << "Post-fix: " << args.top() << endl;
+
+  string regExStr;
+  unordered_map<string, int> alphabetMap;
+  if (!readAlphabet(alphabetMap)) return 0;
+
+  cout << "Enter regular-expression: " << endl;
+  cin >> regExStr;
+
+  string postFix;
+  NFA* nfa = regExToEpsNFA(regExStr, alphabetMap, postFix);
+  cout << "Post-fix: " << postFix << endl;
   cout << "Epsilon-NFA: \n";
-  argsNFA.top()->printNFA();
+  nfa->printNFA();
   
-  argsNFA.top()->convertEpsNFAToNFA();
+  nfa->convertEpsNFAToNFA();
   cout << "===\nNFA: \n";
-  argsNFA.top()->printNFA();
-  DFA dfa(*argsNFA.top());
+  nfa->printNFA();
+  DFA dfa(*nfa);
   cout << "DFA: \n";
   dfa.printDFA();
   dfa.minimizeDFA();
   cout << "MinimizedDFA: \n";
   dfa.printMinDFA();
   cout << endl;
+  delete nfa;
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,122 @@
+#include "common.hpp"
+
+SpanSearcher::SpanSearcher(NFA& nfa) {
+  nAlphabet = nfa.getAlphabet().size();
+
+  DFA forwardDFA(nfa);
+  forwardDFA.minimizeDFA();
+  loadMinDFA(forwardDFA, forwardTrFn, forwardIsFinal, forwardStartState);
+  // phi (id = 0)
+  forwardDeadState = forwardDFA.getMinState(0);
+
+  // reverse(L) with Sigma* prefix, so that the reverse DFA run from the end of
+  // the word accepts at every position where a match starts
+  NFA reverseNFA = nfa;
+  reverseNFA.applyReversal();
+  reverseNFA.applySigmaStarPrefix();
+  DFA reverseDFA(reverseNFA);
+  reverseDFA.minimizeDFA();
+  loadMinDFA(reverseDFA, reverseTrFn, reverseIsFinal, reverseStartState);
+}
+
+void SpanSearcher::loadMinDFA(DFA& dfa, vector<int>& trFn,
+                              vector<bool>& isFinal, int& start) {
+  vector<vector<int>> dfaTrFn = dfa.getTransistionFn();
+  set<int> finalStates = dfa.getFinalStates();
+  int numStates = dfa.getNumStates();
+  // every state is replaced by its equivalent state in the minimized DFA
+  trFn = vector<int>(numStates * nAlphabet);
+  isFinal = vector<bool>(numStates, false);
+  for (int q = 0; q < numStates; ++q) {
+    for (int sym = 0; sym < nAlphabet; ++sym) {
+      trFn[q * nAlphabet + sym] = dfa.getMinState(dfaTrFn[q][sym]);
+    }
+    isFinal[q] = finalStates.find(q) != finalStates.end();
+  }
+  start = dfa.getMinState(dfa.getStartState());
+}
+
+int SpanSearcher::findLongestEnd(vector<int>& word, int start) {
+  int q = forwardStartState;
+  int longestEnd = forwardIsFinal[q] ? start : -1;
+  for (int pos = start; pos < word.size(); ++pos) {
+    q = forwardTrFn[q * nAlphabet + word[pos]];
+    if (q == forwardDeadState) break;
+    if (forwardIsFinal[q]) longestEnd = pos + 1;
+  }
+  return longestEnd;
+}
+
+vector<pair<int, int>> SpanSearcher::findAllSpans(vector<int>& word) {
+  int n = word.size();
+  // isStart[i] = some match starts at i
+  // one pass of the reverse DFA from the end of the word
+  vector<bool> isStart(n + 1);
+  int q = reverseStartState;
+  isStart[n] = reverseIsFinal[q];
+  for (int pos = n - 1; pos >= 0; --pos) {
+    q = reverseTrFn[q * nAlphabet + word[pos]];
+    isStart[pos] = reverseIsFinal[q];
+  }
+
+  // forward DFA is run only from the leftmost start after the last match
+  // exhausted has the pairs (q, pos) from which an earlier forward run found no
+  // match end after pos, a run that reaches such a pair can stop there
+  // (every start is >= the last match end, so the pair can't lead to a longer
+  // match now) -> each pair is scanned at most twice
+  // pair (q, pos) -> pos * numStates + q
+  long long numStates = forwardIsFinal.size();
+  unordered_set<long long> exhausted;
+  // largest pos in exhausted, lookups after it are skipped
+  int lastExhaustedPos = -1;
+  // trace[k] = state of the current run at position start + k
+  vector<int> trace;
+  vector<pair<int, int>> spans;
+  int start = 0;
+  while (start <= n) {
+    if (!isStart[start]) {
+      start++;
+      continue;
+    }
+    trace.clear();
+    int q = forwardStartState;
+    int end = forwardIsFinal[q] ? start : -1;
+    for (int pos = start; pos < n; ++pos) {
+      if (pos <= lastExhaustedPos &&
+          exhausted.find(pos * numStates + q) != exhausted.end()) {
+        break;
+      }
+      trace.push_back(q);
+      q = forwardTrFn[q * nAlphabet + word[pos]];
+      if (q == forwardDeadState) break;
+      if (forwardIsFinal[q]) end = pos + 1;
+    }
+    assert(end >= start);
+    // no match end after end was found from the pairs after end
+    // (the pair at end can only be reached again by a run starting at end)
+    for (int pos = end + 1; pos - start < trace.size(); ++pos) {
+      exhausted.insert(pos * numStates + trace[pos - start]);
+      lastExhaustedPos = max(lastExhaustedPos, pos);
+    }
+    spans.push_back(make_pair(start, end));
+    // an empty match can't be followed by a match at the same position
+    start = (end > start ? end : start + 1);
+  }
+  return spans;
+}
+
+vector<pair<int, int>> SpanSearcher::findAllSpansNaive(vector<int>& word) {
+  int n = word.size();
+  vector<pair<int, int>> spans;
+  int pos = 0;
+  while (pos <= n) {
+    int end = findLongestEnd(word, pos);
+    if (end == -1) {
+      pos++;
+      continue;
+    }
+    spans.push_back(make_pair(pos, end));
+    pos = (end > pos ? end : pos + 1);
+  }
+  return spans;
+}
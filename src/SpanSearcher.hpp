@@ -0,0 +1,49 @@
+#ifndef __SPAN_SEARCHER_HPP__
+#define __SPAN_SEARCHER_HPP__
+
+#include <utility>
+#include <vector>
+
+#include "DFA.hpp"
+#include "NFA.hpp"
+
+using namespace std;
+
+// Finds all the non-overlapping leftmost-longest matches of a regular
+// expression in a word (sequence of symbol ids)
+// a span (start, end) is the match word[start..end)
+// findAllSpans() takes O(n * k) time in the worst case (n = length of the word,
+// k = number of states of the minimized forward DFA), as a (state, position)
+// pair is scanned at most twice; it is O(n) when the forward DFA dies soon
+// after each match
+class SpanSearcher {
+ public:
+  // assm: epsilon-NFA has been converted to NFA
+  SpanSearcher(NFA& nfa);
+  // reverse DFA finds the starts, forward DFA finds the longest end
+  vector<pair<int, int>> findAllSpans(vector<int>& word);
+  // forward DFA is run again from every position
+  vector<pair<int, int>> findAllSpansNaive(vector<int>& word);
+
+ private:
+  // minimized DFAs
+  // trFn[q * nAlphabet + a] = delta(q, a)
+  int nAlphabet;
+  // DFA of L
+  vector<int> forwardTrFn;
+  vector<bool> forwardIsFinal;
+  int forwardStartState;
+  int forwardDeadState;
+  // DFA of Sigma* reverse(L)
+  vector<int> reverseTrFn;
+  vector<bool> reverseIsFinal;
+  int reverseStartState;
+
+  void loadMinDFA(DFA& dfa, vector<int>& trFn, vector<bool>& isFinal,
+                  int& start);
+  // end of the longest match starting at start (-1 if there is no match)
+  // (used by the naive search)
+  int findLongestEnd(vector<int>& word, int start);
+};
+
+#endif
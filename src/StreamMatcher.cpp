@@ -0,0 +1,148 @@
+#include <cctype>
+#include <cstring>
+
+#include "common.hpp"
+
+StreamMatcher::StreamMatcher(DFA& dfa) {
+  unordered_map<string, int> alphabet = dfa.getAlphabet();
+  vector<vector<int>> trFn = dfa.getTransistionFn();
+  set<int> finalStates = dfa.getFinalStates();
+  nAlphabet = alphabet.size();
+  int numStates = dfa.getNumStates();
+
+  // every state is replaced by its equivalent state in the minimized DFA
+  transitionTable = vector<int>(numStates * nAlphabet);
+  isFinal = vector<bool>(numStates, false);
+  for (int q = 0; q < numStates; ++q) {
+    for (int sym = 0; sym < nAlphabet; ++sym) {
+      transitionTable[q * nAlphabet + sym] = dfa.getMinState(trFn[q][sym]);
+    }
+    isFinal[q] = finalStates.find(q) != finalStates.end();
+  }
+  startState = dfa.getMinState(dfa.getStartState());
+  // phi (id = 0)
+  deadState = dfa.getMinState(0);
+
+  // root = 0
+  trieNext = vector<int>(256, -1);
+  trieSymbol = vector<int>(1, -1);
+  trieHasChildren = vector<bool>(1, false);
+  maxSymbolLen = 0;
+  for (auto symIdPair : alphabet) {
+    int node = 0;
+    for (char c : symIdPair.first) {
+      int& next = trieNext[node * 256 + (unsigned char)c];
+      if (next == -1) {
+        next = trieSymbol.size();
+        trieNext.resize(trieNext.size() + 256, -1);
+        trieSymbol.push_back(-1);
+        trieHasChildren.push_back(false);
+      }
+      trieHasChildren[node] = true;
+      node = trieNext[node * 256 + (unsigned char)c];
+    }
+    trieSymbol[node] = symIdPair.second;
+    maxSymbolLen = max(maxSymbolLen, (int)symIdPair.first.size());
+  }
+  // some symbol ends at a node that has children
+  isPrefixFree = true;
+  for (int node = 0; node < trieSymbol.size(); ++node) {
+    if (trieSymbol[node] != -1 && trieHasChildren[node]) {
+      isPrefixFree = false;
+    }
+  }
+
+  // pending never has more than maxSymbolLen characters
+  pending = vector<char>(maxSymbolLen + 1);
+  reset();
+}
+
+void StreamMatcher::setMatchCallback(function<void(long long)> onMatch) {
+  this->onMatch = onMatch;
+}
+
+void StreamMatcher::reset() {
+  currState = startState;
+  pendingLen = 0;
+  pendingStart = 0;
+  streamOffset = 0;
+  trieNode = 0;
+  scanPos = 0;
+  lastSymbol = -1;
+  lastSymbolLen = 0;
+  invalidSymbol = false;
+}
+
+bool StreamMatcher::feed(const char* chunk, int len) {
+  for (int i = 0; i < len && !isDead(); ++i) {
+    if (isspace((unsigned char)chunk[i])) {
+      tokenize(true);
+      pendingStart = streamOffset + 1;
+    } else {
+      pending[pendingLen++] = chunk[i];
+      tokenize(false);
+    }
+    streamOffset++;
+  }
+  return !isDead();
+}
+
+bool StreamMatcher::finish() {
+  tokenize(true);
+  return isAccepting();
+}
+
+bool StreamMatcher::isAccepting() {
+  return !invalidSymbol && isFinal[currState];
+}
+
+bool StreamMatcher::isAlphabetPrefixFree() { return isPrefixFree; }
+
+bool StreamMatcher::isDead() {
+  return invalidSymbol || currState == deadState;
+}
+
+// splits pending into symbols
+// a symbol is taken only when it can't be extended by the next character
+// (or endOfSymbol is set), the characters after it are scanned again
+void StreamMatcher::tokenize(bool endOfSymbol) {
+  while (!invalidSymbol) {
+    if (scanPos < pendingLen) {
+      int next = trieNext[trieNode * 256 + (unsigned char)pending[scanPos]];
+      if (next != -1) {
+        trieNode = next;
+        scanPos++;
+        if (trieSymbol[trieNode] != -1) {
+          lastSymbol = trieSymbol[trieNode];
+          lastSymbolLen = scanPos;
+        }
+        continue;
+      }
+    } else if (pendingLen == 0 ||
+               (!endOfSymbol && trieHasChildren[trieNode])) {
+      // wait for more characters
+      return;
+    }
+
+    if (lastSymbolLen == 0) {
+      invalidSymbol = true;
+      return;
+    }
+    consumeSymbol();
+  }
+}
+
+void StreamMatcher::consumeSymbol() {
+  currState = transitionTable[currState * nAlphabet + lastSymbol];
+  pendingStart += lastSymbolLen;
+  if (onMatch && isFinal[currState]) {
+    onMatch(pendingStart);
+  }
+
+  pendingLen -= lastSymbolLen;
+  memmove(pending.data(), pending.data() + lastSymbolLen, pendingLen);
+  trieNode = 0;
+  scanPos = 0;
+  lastSymbol = -1;
+  lastSymbolLen = 0;
+}
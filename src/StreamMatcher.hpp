@@ -0,0 +1,81 @@
+#ifndef __STREAM_MATCHER_HPP__
+#define __STREAM_MATCHER_HPP__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "DFA.hpp"
+
+using namespace std;
+
+// Runs a minimized DFA over a stream of characters fed in chunks
+// - characters are split into symbols of the alphabet greedily (a symbol is
+// taken only when the next character can't extend it), a symbol may be split
+// across chunks
+// - if a symbol is a prefix of another symbol, the split may not be the one
+// the regex needs, and a string in the language can be rejected
+// (e.g. alphabet {A, AB, BC}, regex A.BC, input "ABC" is split as AB, C)
+// such symbols must be seperated by white-spaces, see isAlphabetPrefixFree()
+// - white-spaces separate symbols and are otherwise ignored
+// - feed() never blocks or allocates, so it can be called from any I/O loop
+class StreamMatcher {
+ public:
+  // assm: minimizeDFA() has been called on dfa
+  StreamMatcher(DFA& dfa);
+  // onMatch(offset) is called whenever the input read till offset (offset is
+  // the end of the last symbol) is accepted
+  void setMatchCallback(function<void(long long)> onMatch);
+  // returns false once no continuation of the stream can be accepted
+  bool feed(const char* chunk, int len);
+  // end of stream, returns true if the whole stream is accepted
+  bool finish();
+  // accept status of the symbols read so far
+  bool isAccepting();
+  bool isDead();
+  // true if no symbol is a prefix of another symbol (the split is then the
+  // only possible one)
+  bool isAlphabetPrefixFree();
+  void reset();
+
+ private:
+  // minimized DFA
+  // transitionTable[q * nAlphabet + a] = delta(q, a)
+  int nAlphabet;
+  vector<int> transitionTable;
+  vector<bool> isFinal;
+  int startState;
+  int deadState;
+
+  // trie of the symbols of the alphabet
+  // trieNext[node * 256 + c] = child of node for character c (-1 if none)
+  vector<int> trieNext;
+  // trieSymbol[node] = id of the symbol ending at node (-1 if none)
+  vector<int> trieSymbol;
+  vector<bool> trieHasChildren;
+  int maxSymbolLen;
+  bool isPrefixFree;
+
+  // state of the stream
+  int currState;
+  // characters of the symbol that is not yet complete
+  vector<char> pending;
+  int pendingLen;
+  // offset of pending[0] in the stream
+  long long pendingStart;
+  long long streamOffset;
+  // tokenizer: trie node reached by pending[0..scanPos) and the longest
+  // symbol seen on the way
+  int trieNode;
+  int scanPos;
+  int lastSymbol;
+  int lastSymbolLen;
+  bool invalidSymbol;
+
+  function<void(long long)> onMatch;
+
+  void tokenize(bool endOfSymbol);
+  void consumeSymbol();
+};
+
+#endif
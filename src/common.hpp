@@ -1,11 +1,18 @@
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <queue>
 #include <stack>
+#include <unordered_set>
 
+#include "CompileServer.hpp"
 #include "DFA.hpp"
 #include "NFA.hpp"
+#include "RegEx.hpp"
+#include "SpanSearcher.hpp"
+#include "StreamMatcher.hpp"
 
 using namespace std;
 
-const string INVALID_REGEX_EXCEPTION = "Invalid regular expression";
\ No newline at end of file
+const string INVALID_REGEX_EXCEPTION = "Invalid regular expression";
+const string INVALID_SYMBOL_EXCEPTION = "Symbol is not in the alphabet";
\ No newline at end of file